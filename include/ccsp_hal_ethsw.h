@@ -234,6 +234,21 @@ typedef enum _CCSP_HAL_ETHSW_ADMIN_STATUS {
 * TODO: Evaluate if the typedef (`_CCSP_HAL_ETHSW_ADMIN_STATUS & *PCCSP_HAL_ETHSW_ADMIN_STATUS`) is necessary.
 */
 
+/**! Log levels for the vendor HAL log (`ethsw_vendor_hal.log`), in descending order of severity. */
+typedef enum _CCSP_HAL_ETHSW_LOG_LEVEL
+{
+    CCSP_HAL_ETHSW_LOG_FATAL = 0,   /**!< Critical conditions requiring immediate attention. */
+    CCSP_HAL_ETHSW_LOG_ERROR,       /**!< Non-fatal errors that impede normal operation. */
+    CCSP_HAL_ETHSW_LOG_WARNING,     /**!< Potentially harmful situations. */
+    CCSP_HAL_ETHSW_LOG_NOTICE,      /**!< Important but not error-level events. */
+    CCSP_HAL_ETHSW_LOG_INFO,        /**!< General informational messages. */
+    CCSP_HAL_ETHSW_LOG_DEBUG,       /**!< Detailed diagnostic messages. */
+    CCSP_HAL_ETHSW_LOG_TRACE        /**!< Very fine-grained internal flow tracing. */
+} CCSP_HAL_ETHSW_LOG_LEVEL, *PCCSP_HAL_ETHSW_LOG_LEVEL;
+
+/**! Log level in force in each process until `CcspHalEthSwSetLogLevel()` is called. */
+#define CCSP_HAL_ETHSW_LOG_DEFAULT_LEVEL CCSP_HAL_ETHSW_LOG_INFO
+
 /**********************************************************************
                 STRUCTURE DEFINITIONS
 **********************************************************************/
@@ -262,6 +277,12 @@ typedef struct _CCSP_HAL_ETH_STATS {
 *   - Verify and document the specific units for each statistic (e.g., bytes, packets, errors per second or total).
 */
 
+/**! Represents counters of the vendor HAL logging subsystem. */
+typedef struct _CCSP_HAL_ETHSW_LOG_STATS {
+    ULLONG RecordsWritten;      /**!< Number of log records written to the log file or syslog. */
+    ULLONG RecordsDropped;      /**!< Number of log records discarded because the logging backlog was full. */
+} CCSP_HAL_ETHSW_LOG_STATS, *PCCSP_HAL_ETHSW_LOG_STATS;
+
 /**
  * @}
  */
@@ -596,6 +617,53 @@ INT CcspHalExtSw_setEthWanPort(UINT Port);
  */
 INT CcspHalEthSwGetEthPortStats(CCSP_HAL_ETHSW_PORT PortId, PCCSP_HAL_ETH_STATS pStats);
 
+/**!
+ * @brief Sets the runtime log level of the vendor HAL log.
+ *
+ * Messages with a severity lower than `Level` are discarded at the call site. The new level applies to log calls of the calling thread made after this function returns, and to other threads of the calling process shortly afterwards, without restarting the HAL.
+ *
+ * The level is per process: it affects only the calling process, and each process using the HAL must set its own level. Until it is set, `CCSP_HAL_ETHSW_LOG_DEFAULT_LEVEL` is in force.
+ *
+ * This function is thread safe and may be called concurrently with any other HAL API and with the logging drainer. It may be called before `CcspHalEthSwInit()`; the level is then in force immediately and persists through initialization.
+ *
+ * @param[in] Level - New log level (see `CCSP_HAL_ETHSW_LOG_LEVEL`).
+ *
+ * @returns Status of the operation:
+ * @retval RETURN_OK - On success.
+ * @retval RETURN_ERR - On failure (e.g., invalid log level).
+ */
+INT CcspHalEthSwSetLogLevel(CCSP_HAL_ETHSW_LOG_LEVEL Level);
+
+/**!
+ * @brief Retrieves the current runtime log level of the vendor HAL log.
+ *
+ * The level is per process. If `CcspHalEthSwSetLogLevel()` has not been called in the calling process, `CCSP_HAL_ETHSW_LOG_DEFAULT_LEVEL` is returned.
+ *
+ * This function is thread safe and may be called concurrently with any other HAL API and with the logging drainer. It may be called before `CcspHalEthSwInit()`.
+ *
+ * @param[out] pLevel - Pointer to a `CCSP_HAL_ETHSW_LOG_LEVEL` variable to store the log level.
+ *
+ * @returns Status of the operation:
+ * @retval RETURN_OK - On success.
+ * @retval RETURN_ERR - On failure (e.g., null pointer).
+ */
+INT CcspHalEthSwGetLogLevel(PCCSP_HAL_ETHSW_LOG_LEVEL pLevel);
+
+/**!
+ * @brief Retrieves the counters of the vendor HAL logging subsystem.
+ *
+ * The counters are per process: they cover only the records logged by the calling process, are cumulative since the HAL library was loaded into it, and allow the caller to detect log records lost under load.
+ *
+ * This function is thread safe and may be called concurrently with any other HAL API and with the logging drainer. The counters are a best-effort snapshot and need not be mutually consistent. It may be called before `CcspHalEthSwInit()`, in which case all counters are zero.
+ *
+ * @param[out] pStats - Pointer to a `CCSP_HAL_ETHSW_LOG_STATS` structure to store the counters.
+ *
+ * @returns Status of the operation:
+ * @retval RETURN_OK - On success.
+ * @retval RETURN_ERR - On failure (e.g., null pointer).
+ */
+INT CcspHalEthSwGetLogStats(PCCSP_HAL_ETHSW_LOG_STATS pStats);
+
 /**
  * @}
  */